@@ -50,6 +50,8 @@
 #define STS_ERR_TRY_AGAIN                                   (-6)
 /** An operation would block and no blocking behavior was requested. */
 #define STS_INF_TRY_AGAIN                                   (6)
+/** A wait operation ran into a timeout. */
+#define STS_ERR_TIMEOUT                                     (-7)
 
 
 /*
@@ -28,6 +28,7 @@
 
 #if defined(IN_PSP)
 # include <common/types.h>
+# include <common/cdefs.h>
 #else
 # error "Invalid environment"
 #endif
@@ -40,6 +41,51 @@
 /** Pointer to a const code module interface callback table. */
 typedef const struct CMIF *PCCMIF;
 
+
+/**
+ * Output ring header, located at the start of the ring memory provided by the code module.
+ *
+ * The ring is single producer (the code module) and single consumer (the stub). Both indices
+ * are free running byte counters, the position in the data area is the index modulo cbData.
+ * The module only advances offProducer and the stub only advances offConsumer after the data was sent,
+ * so no locking is required. The data area directly follows the header.
+ */
+typedef struct CMOUTRING
+{
+    /** Producer index, written by the code module after the data was copied to the ring. */
+    volatile uint32_t       offProducer;
+    /** Consumer index, written by the stub after the data was sent to the external side. */
+    volatile uint32_t       offConsumer;
+    /** Size of the data area in bytes, must be a power of two. */
+    uint32_t                cbData;
+    /** Number of bytes dropped because the ring was full (only if CM_OUT_RING_F_DROP_IF_FULL is set). */
+    volatile uint32_t       cbDropped;
+} CMOUTRING;
+/** Pointer to an output ring header. */
+typedef CMOUTRING *PCMOUTRING;
+
+/** Returns the number of bytes ready to be consumed in the given ring. */
+#define CM_OUT_RING_USED(a_pRing)       ((a_pRing)->offProducer - (a_pRing)->offConsumer)
+/** Returns the number of bytes free in the given ring. */
+#define CM_OUT_RING_FREE(a_pRing)       ((a_pRing)->cbData - CM_OUT_RING_USED(a_pRing))
+/** Returns the pointer to the data area of the given ring. */
+#define CM_OUT_RING_DATA(a_pRing)       ((uint8_t *)((a_pRing) + 1))
+
+/** Drop data if the ring is full instead of waiting for the stub to drain it. */
+#define CM_OUT_RING_F_DROP_IF_FULL      BIT(0)
+
+/** @name Events for CMIF::pfnEvtWait.
+ * @{ */
+/** One of the selected input buffers has data available. */
+#define CM_EVT_F_IN_BUF                 BIT(0)
+/** An IRQ is pending. */
+#define CM_EVT_F_IRQ                    BIT(1)
+/** A FIQ is pending. */
+#define CM_EVT_F_FIQ                    BIT(2)
+/** The timer armed with CMIF::pfnTimerArm expired. */
+#define CM_EVT_F_TIMER                  BIT(3)
+/** @} */
+
 /**
  * The interface callback table for the code module to use.
  */
@@ -106,6 +152,114 @@ typedef struct CMIF
      */
     uint32_t (*pfnTsGetMilli) (PCCMIF pCmIf);
 
+    /**
+     * Switches the given output buffer to ring mode.
+     *
+     * The code module writes to the ring directly (pfnOutBufWrite must not be used for the buffer afterwards)
+     * and the stub drains it in PDUs as large as possible while waiting for input or when pfnDelayMs() is called.
+     * Passing NULL for pRing flushes the ring and switches back to the normal mode.
+     *
+     * @returns Status code.
+     * @param   pCmIf               Pointer to this interface table.
+     * @param   idOutBuf            Output buffer ID to use the ring for.
+     * @param   pRing               The ring header, cbData and the data area following must be initialized
+     *                              and the indices set to 0.
+     * @param   fFlags              Flags controlling the ring behavior, CM_OUT_RING_F_XXX.
+     */
+    int    (*pfnOutBufRingSetup) (PCCMIF pCmIf, uint32_t idOutBuf, PCMOUTRING pRing, uint32_t fFlags);
+
+    /**
+     * Waits until any of the given events occurs.
+     *
+     * Unlike pfnInBufPoll() this doesn't spin, the stub sleeps in WFI and is woken up by the UART receive
+     * interrupt, the other interrupts or the timer, so input is handed to the module as soon as the PDU was received.
+     *
+     * @returns Status code, STS_ERR_TIMEOUT if none of the events occurred within the given time.
+     * @param   pCmIf               Pointer to this interface table.
+     * @param   fEvts               The events to wait for, CM_EVT_F_XXX.
+     * @param   bmInBufs            Bitmap of input buffer IDs to watch for CM_EVT_F_IN_BUF.
+     * @param   cMillies            How many milliseconds to wait, CM_WAIT_INDEFINITE to wait until an event occurs.
+     * @param   pfEvtsPending       Where to store the pending events out of fEvts, optional.
+     */
+    int    (*pfnEvtWait) (PCCMIF pCmIf, uint32_t fEvts, uint32_t bmInBufs, uint32_t cMillies, uint32_t *pfEvtsPending);
+
+    /**
+     * Arms the timer raising CM_EVT_F_TIMER.
+     *
+     * @returns Status code.
+     * @param   pCmIf               Pointer to this interface table.
+     * @param   cMillies            Number of milliseconds until the timer expires, 0 to disarm the timer.
+     * @param   fPeriodic           Flag whether the timer re-arms itself after expiring.
+     */
+    int    (*pfnTimerArm) (PCCMIF pCmIf, uint32_t cMillies, bool fPeriodic);
+
+    /**
+     * Lends the code module a pointer to the data available in the given input buffer without copying it.
+     *
+     * The data stays valid until pfnInBufRelease() is called, only one region per input buffer can be acquired
+     * at a time and no other input buffer callbacks must be used for the buffer in between.
+     *
+     * @returns Status code.
+     * @param   pCmIf               Pointer to this interface table.
+     * @param   idInBuf             Input buffer ID to acquire the data from.
+     * @param   ppv                 Where to store the pointer to the data.
+     * @param   pcb                 Where to store the number of contiguous bytes available (can be less
+     *                              than what pfnInBufPeek() returns if the data wraps around).
+     */
+    int    (*pfnInBufAcquire) (PCCMIF pCmIf, uint32_t idInBuf, const void **ppv, size_t *pcb);
+
+    /**
+     * Releases data acquired with pfnInBufAcquire().
+     *
+     * @returns Status code.
+     * @param   pCmIf               Pointer to this interface table.
+     * @param   idInBuf             Input buffer ID the data was acquired from.
+     * @param   cbConsumed          Number of bytes consumed from the start of the acquired region, the remainder
+     *                              stays in the input buffer.
+     */
+    int    (*pfnInBufRelease) (PCCMIF pCmIf, uint32_t idInBuf, size_t cbConsumed);
+
+    /**
+     * Lends the code module a pointer into the stub's transmit buffer for the given output buffer,
+     * the data written there is sent without another copy.
+     *
+     * @returns Status code.
+     * @param   pCmIf               Pointer to this interface table.
+     * @param   idOutBuf            Output buffer ID to acquire space for.
+     * @param   cbMin               Minimum number of bytes required, waits until the space is available.
+     * @param   ppv                 Where to store the pointer to the space.
+     * @param   pcb                 Where to store the number of bytes available (at least cbMin and at most
+     *                              the payload of a single PDU).
+     */
+    int    (*pfnOutBufAcquire) (PCCMIF pCmIf, uint32_t idOutBuf, size_t cbMin, void **ppv, size_t *pcb);
+
+    /**
+     * Commits the space acquired with pfnOutBufAcquire() and sends it to the external side.
+     *
+     * @returns Status code.
+     * @param   pCmIf               Pointer to this interface table.
+     * @param   idOutBuf            Output buffer ID the space was acquired for.
+     * @param   cbWritten           Number of bytes written from the start of the acquired space, 0 to discard it.
+     */
+    int    (*pfnOutBufCommit) (PCCMIF pCmIf, uint32_t idOutBuf, size_t cbWritten);
+
+    /**
+     * Returns a microsecond precision timestamp since some arbitrary point in the past (usually startup time).
+     *
+     * @returns Microsecond timestamp.
+     * @param   pCmIf               Pointer to this interface table.
+     */
+    uint64_t (*pfnTsGetMicro) (PCCMIF pCmIf);
+
+    /**
+     * Returns the CPU cycle counter (PMCCNTR, see psp/pmu.h) extended to 64bit by the stub.
+     *
+     * @returns Cycle count.
+     * @param   pCmIf               Pointer to this interface table.
+     * @param   pu32FreqKHz         Where to store the cycle counter frequency in kHz, optional.
+     */
+    uint64_t (*pfnTsGetCycles) (PCCMIF pCmIf, uint32_t *pu32FreqKHz);
+
 } CMIF;
 /** Pointer to a code module interface callback table. */
 typedef CMIF *PCMIF;
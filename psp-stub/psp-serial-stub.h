@@ -60,6 +60,12 @@
 #define PSP_SERIAL_STS_DATA_ABORT_EXCEPTION             (-4)
 /** Request caused prefetch abort exception. */
 #define PSP_SERIAL_STS_PREFETCH_ABORT_EXCEPTION         (-5)
+/** Operation was not executed because an earlier one in the same batch failed. */
+#define PSP_SERIAL_STS_ERR_BATCH_SKIPPED                (-6)
+/** The request ID is not supported by this stub (or not enabled during connect). */
+#define PSP_SERIAL_STS_ERR_NOT_SUPPORTED                (-7)
+/** The requested object was not found (e.g. code module cache miss). */
+#define PSP_SERIAL_STS_ERR_NOT_FOUND                    (-8)
 /** @} */
 
 
@@ -83,6 +89,12 @@ typedef enum PSPSERIALPDURRNID
     PSPSERIALPDURRNID_NOTIFICATION_OUT_BUF,
     /** Notification: Code module execution has finished. */
     PSPSERIALPDURRNID_NOTIFICATION_CODE_MOD_EXEC_FINISHED,
+    /** Notification: Output buffer data drained from a code module output ring. */
+    PSPSERIALPDURRNID_NOTIFICATION_OUT_BUF_RING,
+    /** Notification: Request PDUs were discarded because of a gap in the PDU counter (pipelining only). */
+    PSPSERIALPDURRNID_NOTIFICATION_REQ_GAP,
+    /** Notification: The link configuration fell back to the previous settings. */
+    PSPSERIALPDURRNID_NOTIFICATION_LINK_FALLBACK,
     /** Notification: First invalid notification ID. */
     PSPSERIALPDURRNID_NOTIFICATION_INVALID_FIRST,
 
@@ -124,6 +136,30 @@ typedef enum PSPSERIALPDURRNID
     PSPSERIALPDURRNID_REQUEST_EXEC_CODE_MOD,
     /** Request: Branch to address (this will likely kill the stub). */
     PSPSERIALPDURRNID_REQUEST_BRANCH_TO,
+    /** Request: Batch of several generic data transfers. */
+    PSPSERIALPDURRNID_REQUEST_BATCH,
+    /** Request: Hash PSP SRAM blockwise. */
+    PSPSERIALPDURRNID_REQUEST_PSP_MEM_HASH,
+    /** Request: Scatter/gather data transfer across address spaces. */
+    PSPSERIALPDURRNID_REQUEST_PSP_DATA_XFER_SG,
+    /** Request: Query notification statistics. */
+    PSPSERIALPDURRNID_REQUEST_QUERY_NOT_STATS,
+    /** Request: Change the link configuration. */
+    PSPSERIALPDURRNID_REQUEST_LINK_CFG_SET,
+    /** Request: Link test pattern (echoed back). */
+    PSPSERIALPDURRNID_REQUEST_LINK_TEST,
+    /** Request: Fragment of a request exceeding the maximum PDU size. */
+    PSPSERIALPDURRNID_REQUEST_FRAGMENT,
+    /** Request: Retransmit selected segments of a generic data transfer read. */
+    PSPSERIALPDURRNID_REQUEST_PSP_DATA_XFER_NACK,
+    /** Request: Execute a request on several CCDs concurrently. */
+    PSPSERIALPDURRNID_REQUEST_CCD_FANOUT,
+    /** Request: Search for a pattern in a generic data transfer range. */
+    PSPSERIALPDURRNID_REQUEST_PSP_DATA_SEARCH,
+    /** Request: Load code module from the cache if present. */
+    PSPSERIALPDURRNID_REQUEST_LOAD_CODE_MOD_CACHED,
+    /** Request: Query the current and supported link configurations. */
+    PSPSERIALPDURRNID_REQUEST_LINK_CFG_QUERY,
     /** Request: First invalid request ID. */
     PSPSERIALPDURRNID_REQUEST_INVALID_FIRST,
 
@@ -165,6 +201,30 @@ typedef enum PSPSERIALPDURRNID
     PSPSERIALPDURRNID_RESPONSE_EXEC_CODE_MOD,
     /** Response: Branch to address (response is send before the actual branch). */
     PSPSERIALPDURRNID_RESPONSE_BRANCH_TO,
+    /** Response: Batch of several generic data transfers. */
+    PSPSERIALPDURRNID_RESPONSE_BATCH,
+    /** Response: Hash PSP SRAM blockwise. */
+    PSPSERIALPDURRNID_RESPONSE_PSP_MEM_HASH,
+    /** Response: Scatter/gather data transfer across address spaces. */
+    PSPSERIALPDURRNID_RESPONSE_PSP_DATA_XFER_SG,
+    /** Response: Query notification statistics. */
+    PSPSERIALPDURRNID_RESPONSE_QUERY_NOT_STATS,
+    /** Response: Change the link configuration. */
+    PSPSERIALPDURRNID_RESPONSE_LINK_CFG_SET,
+    /** Response: Link test pattern (echoed back). */
+    PSPSERIALPDURRNID_RESPONSE_LINK_TEST,
+    /** Response: Fragment of a request exceeding the maximum PDU size. */
+    PSPSERIALPDURRNID_RESPONSE_FRAGMENT,
+    /** Response: Retransmit selected segments of a generic data transfer read. */
+    PSPSERIALPDURRNID_RESPONSE_PSP_DATA_XFER_NACK,
+    /** Response: Execute a request on several CCDs concurrently. */
+    PSPSERIALPDURRNID_RESPONSE_CCD_FANOUT,
+    /** Response: Search for a pattern in a generic data transfer range. */
+    PSPSERIALPDURRNID_RESPONSE_PSP_DATA_SEARCH,
+    /** Response: Load code module from the cache if present. */
+    PSPSERIALPDURRNID_RESPONSE_LOAD_CODE_MOD_CACHED,
+    /** Response: Query the current and supported link configurations. */
+    PSPSERIALPDURRNID_RESPONSE_LINK_CFG_QUERY,
     /** Response: First invalid response ID. */
     PSPSERIALPDURRNID_RESPONSE_INVALID_FIRST,
 
@@ -184,7 +244,11 @@ typedef enum PSPSERIALCMTYPE
     PSPSERIALCMTYPE_INVALID = 0,
     /** Flat binary loaded at a fixed address determined by the serial stub. */
     PSPSERIALCMTYPE_FLAT_BINARY,
-    /** @todo ELF. */
+    /** ELF image placed anywhere in the host managed scratch space, the host parses the program headers and writes the loadable
+     * segments with generic data transfers beforehand (BSS is cleared with PSP_SERIAL_DATA_XFER_F_MEMSET),
+     * the load request carries a PSPSERIALLOADCODEMODELF descriptor followed by the relocations. */
+    PSPSERIALCMTYPE_ELF,
+    /** 32bit hack. */
     PSPSERIALCMTYPE_32BIT_HACK = 0x7fffffff
 } PSPSERIALCMTYPE;
 
@@ -217,8 +281,9 @@ typedef struct PSPSERIALPDUHDR
             PSPSTS                      rcReq;
             /** Millisecond timestamp when a response/notification was sent, ignored for requests. */
             uint32_t                    tsMillies;
-            /** Padding to 32 bytes. */
-            uint32_t                    u32Pad0;
+            /** PDU counter of the request a response belongs to (only valid if pipelining was negotiated,
+             * ignored for requests and notifications). */
+            uint32_t                    cPdusReq;
         } Fields;
     } u;
 } PSPSERIALPDUHDR;
@@ -232,6 +297,27 @@ _Static_assert(sizeof(PSPSERIALPDUHDR) == 32, "PDU header has invalid size!");
 #endif
 
 
+/**
+ * Extended PDU header, only present if PSP_SERIAL_CONNECT_F_HDR_EXT was negotiated.
+ *
+ * Starts the payload of every response and notification and is included in PSPSERIALPDUHDR::cbPdu.
+ */
+typedef struct PSPSERIALPDUHDREXT
+{
+    /** Cycle counter value (PMCCNTR extended to 64bit) when the response/notification was sent,
+     * see PSPSERIALCONNECTRESP::u32CycleFreqKHz. */
+    uint64_t                            tsCycles;
+} PSPSERIALPDUHDREXT;
+/** Pointer to an extended PDU header. */
+typedef PSPSERIALPDUHDREXT *PPSPSERIALPDUHDREXT;
+/** Pointer to a const extended PDU header. */
+typedef const PSPSERIALPDUHDREXT *PCPSPSERIALPDUHDREXT;
+
+#ifdef __GNUC__
+_Static_assert(sizeof(PSPSERIALPDUHDREXT) == 8, "Extended PDU header has invalid size!");
+#endif
+
+
 /**
  * PDU footer common for both directions.
  */
@@ -247,6 +333,30 @@ typedef PSPSERIALPDUFOOTER *PPSPSERIALPDUFOOTER;
 /** Pointer to a const PSP serial PDU header. */
 typedef const PSPSERIALPDUFOOTER *PCPSPSERIALPDUFOOTER;
 
+#ifdef __GNUC__
+_Static_assert(sizeof(PSPSERIALPDUFOOTER) == 8, "PDU footer has invalid size!");
+#endif
+
+
+/** @name PDU framing helpers, shared by all parsers so the framing rules live in one place.
+ * @{ */
+/** Alignment of the PDU payload, the footer starts at the next aligned offset after the payload. */
+#define PSP_SERIAL_PDU_ALIGNMENT                        8
+/** Returns the payload size including the padding before the footer for the given PSPSERIALPDUHDR::cbPdu. */
+#define PSP_SERIAL_PDU_PAYLOAD_SIZE_PADDED(a_cbPdu)     (((a_cbPdu) + PSP_SERIAL_PDU_ALIGNMENT - 1) & ~(PSP_SERIAL_PDU_ALIGNMENT - 1))
+/** Returns the offset of the footer from the start of the PDU for the given PSPSERIALPDUHDR::cbPdu. */
+#define PSP_SERIAL_PDU_FOOTER_OFF(a_cbPdu)              (sizeof(PSPSERIALPDUHDR) + PSP_SERIAL_PDU_PAYLOAD_SIZE_PADDED(a_cbPdu))
+/** Returns the complete size of a PDU on the wire for the given PSPSERIALPDUHDR::cbPdu. */
+#define PSP_SERIAL_PDU_SIZE_TOTAL(a_cbPdu)              (PSP_SERIAL_PDU_FOOTER_OFF(a_cbPdu) + sizeof(PSPSERIALPDUFOOTER))
+/** Number of bytes covered by the checksum (header without the start magic, payload and padding). */
+#define PSP_SERIAL_PDU_CHKSUM_SIZE(a_cbPdu)             (PSP_SERIAL_PDU_FOOTER_OFF(a_cbPdu) - sizeof(uint32_t))
+/** Returns the footer checksum from the running byte sum over the covered bytes.
+ * The byte sum can be accumulated incrementally over arbitrary chunks as addition is associative. */
+#define PSP_SERIAL_PDU_CHKSUM_FROM_SUM(a_u32Sum)        ((uint32_t)(0 - (uint32_t)(a_u32Sum)))
+/** Returns true if the running byte sum over the covered bytes matches the footer checksum. */
+#define PSP_SERIAL_PDU_CHKSUM_IS_VALID(a_u32Sum, a_u32ChkSum) (((uint32_t)(a_u32Sum) + (uint32_t)(a_u32ChkSum)) == 0)
+/** @} */
+
 
 /**
  * PSP serial stub beacon notification data.
@@ -264,6 +374,29 @@ typedef PSPSERIALBEACONNOT *PPSPSERIALBEACONNOT;
 typedef const PSPSERIALBEACONNOT *PCPSPSERIALBEACONNOT;
 
 
+/**
+ * PSP serial stub request gap notification data (pipelining only).
+ *
+ * The stub only executes a request PDU if its PSPSERIALPDUHDR::cPdus is the next expected value, any other PDU
+ * (and every PDU failing the checksum) is discarded without a response. When the first PDU following a gap arrives
+ * the stub sends this notification once, further discarded PDUs don't cause another one until the expected PDU was
+ * received. The external side then resends all requests starting with cPdusExpected, reusing their original counters,
+ * so requests are always executed in order. If the last PDU in the window was lost there is nothing to reveal the gap
+ * and the external side resends from the oldest request without a response after a timeout.
+ */
+typedef struct PSPSERIALREQGAPNOT
+{
+    /** The PDU counter the stub expects next. */
+    uint32_t                            cPdusExpected;
+    /** The PDU counter of the first discarded PDU which revealed the gap. */
+    uint32_t                            cPdusReceived;
+} PSPSERIALREQGAPNOT;
+/** Pointer to request gap notification data. */
+typedef PSPSERIALREQGAPNOT *PPSPSERIALREQGAPNOT;
+/** Pointer to a const request gap notification. */
+typedef const PSPSERIALREQGAPNOT *PCPSPSERIALREQGAPNOT;
+
+
 /**
  * PSP serial stub interrupt status change notification.
  */
@@ -273,8 +406,9 @@ typedef struct PSPSERIALIRQNOT
     uint16_t                            fIrqCur;
     /** Previous interrupt status flags. */
     uint16_t                            fIrqPrev;
-    /** Padding to 8 byte alignment. */
-    uint32_t                            u32Pad0;
+    /** Number of intermediate state transitions between fIrqPrev and fIrqCur which were merged
+     * into this notification (always 0 if notification coalescing was not negotiated). */
+    uint32_t                            cIrqChgsMerged;
 } PSPSERIALIRQNOT;
 /** Pointer to beacon notification data. */
 typedef PSPSERIALIRQNOT *PPSPSERIALIRQNOT;
@@ -287,6 +421,142 @@ typedef const PSPSERIALIRQNOT *PCPSPSERIALIRQNOT;
 #define PSP_SERIAL_NOTIFICATION_IRQ_PENDING_FIQ     BIT(1)
 
 
+/**
+ * PSP serial stub notification statistics response data.
+ */
+typedef struct PSPSERIALNOTSTATSRESP
+{
+    /** Number of interrupt notifications sent. */
+    uint32_t                            cIrqNotsSent;
+    /** Number of interrupt state transitions merged into other notifications. */
+    uint32_t                            cIrqChgsMerged;
+    /** Number of log message notifications sent. */
+    uint32_t                            cLogMsgNotsSent;
+    /** Number of log messages batched into other notifications. */
+    uint32_t                            cLogMsgsMerged;
+    /** Number of notifications dropped because the notification ring was full. */
+    uint32_t                            cNotsDropped;
+    /** Padding to 8 byte alignment. */
+    uint32_t                            u32Pad0;
+} PSPSERIALNOTSTATSRESP;
+/** Pointer to notification statistics response data. */
+typedef PSPSERIALNOTSTATSRESP *PPSPSERIALNOTSTATSRESP;
+/** Pointer to a const notification statistics response. */
+typedef const PSPSERIALNOTSTATSRESP *PCPSPSERIALNOTSTATSRESP;
+
+
+/**
+ * PSP serial stub link configuration request data.
+ *
+ * The baud rate is X86_UART_BAUD_FROM_CLK_DIVISOR(u32ClkHz, u32Divisor), speeds above X86_UART_BAUD_RATE_BASE
+ * require a UART input clock faster than X86_UART_CLK_HZ_DEFAULT, the clocks supported by the stub are reported by
+ * PSPSERIALPDURRNID_REQUEST_LINK_CFG_QUERY. An unsupported clock or a divisor outside of
+ * [X86_UART_DIVISOR_MIN, X86_UART_DIVISOR_MAX] is rejected with PSP_SERIAL_STS_ERR_INVALID_PARAMETER.
+ *
+ * The response is sent with the old settings, afterwards both sides switch to the new clock and divisor.
+ * The external side has to send a PSPSERIALPDURRNID_REQUEST_LINK_TEST PDU with the test pattern
+ * within cMilliesVerify, otherwise (or if the PDU is corrupted) the stub falls back to the previous
+ * settings and sends a PSPSERIALPDURRNID_NOTIFICATION_LINK_FALLBACK. The external side does the same
+ * if it receives no valid echo.
+ */
+typedef struct PSPSERIALLINKCFGREQ
+{
+    /** The new UART divisor latch value (see X86_UART_DIVISOR_FROM_CLK_BAUD()). */
+    uint32_t                            u32Divisor;
+    /** Number of milliseconds to wait for the test pattern before falling back. */
+    uint32_t                            cMilliesVerify;
+    /** The new UART input clock in Hz, 0 to keep the current one. */
+    uint32_t                            u32ClkHz;
+    /** Padding to 8 byte alignment. */
+    uint32_t                            u32Pad0;
+} PSPSERIALLINKCFGREQ;
+/** Pointer to link configuration request data. */
+typedef PSPSERIALLINKCFGREQ *PPSPSERIALLINKCFGREQ;
+/** Pointer to a const link configuration request. */
+typedef const PSPSERIALLINKCFGREQ *PCPSPSERIALLINKCFGREQ;
+
+#ifdef __GNUC__
+_Static_assert(sizeof(PSPSERIALLINKCFGREQ) == 16, "Link configuration descriptor has invalid size!");
+#endif
+
+
+/**
+ * PSP serial stub link configuration query response data.
+ *
+ * Followed by cClks 32bit UART input clocks in Hz the stub can select, padded to the next 8 byte alignment.
+ */
+typedef struct PSPSERIALLINKCFGQUERYRESP
+{
+    /** The current UART input clock in Hz. */
+    uint32_t                            u32ClkHz;
+    /** The current UART divisor latch value. */
+    uint32_t                            u32Divisor;
+    /** Number of supported clocks following. */
+    uint32_t                            cClks;
+    /** Padding to 8 byte alignment. */
+    uint32_t                            u32Pad0;
+} PSPSERIALLINKCFGQUERYRESP;
+/** Pointer to link configuration query response data. */
+typedef PSPSERIALLINKCFGQUERYRESP *PPSPSERIALLINKCFGQUERYRESP;
+/** Pointer to a const link configuration query response. */
+typedef const PSPSERIALLINKCFGQUERYRESP *PCPSPSERIALLINKCFGQUERYRESP;
+
+
+/**
+ * PSP serial stub link fallback notification data, sent with the restored settings.
+ */
+typedef struct PSPSERIALLINKFALLBACKNOT
+{
+    /** The restored UART input clock in Hz. */
+    uint32_t                            u32ClkHz;
+    /** The restored UART divisor latch value. */
+    uint32_t                            u32Divisor;
+} PSPSERIALLINKFALLBACKNOT;
+/** Pointer to link fallback notification data. */
+typedef PSPSERIALLINKFALLBACKNOT *PPSPSERIALLINKFALLBACKNOT;
+/** Pointer to a const link fallback notification. */
+typedef const PSPSERIALLINKFALLBACKNOT *PCPSPSERIALLINKFALLBACKNOT;
+
+
+/**
+ * PSP serial stub request fragment header.
+ *
+ * The header is followed by cbFrag bytes of the original request payload starting at offFrag.
+ * The stub reassembles the payload in the reassembly area (PSPSERIALCONNECTRESPSCRATCH) and acknowledges every
+ * fragment but the last with a PSPSERIALPDURRNID_RESPONSE_FRAGMENT. After the last fragment was received the original
+ * request is executed and its response is sent instead. The complete payload must fit into the reassembly area.
+ */
+typedef struct PSPSERIALFRAGREQ
+{
+    /** The request ID of the fragmented request. */
+    PSPSERIALPDURRNID                   enmRrnIdReq;
+    /** Fragment index, fragments must be sent in order starting at 0. */
+    uint32_t                            idxFrag;
+    /** Total number of fragments. */
+    uint32_t                            cFrags;
+    /** Total size of the reassembled request payload in bytes. */
+    uint32_t                            cbTotal;
+    /** Offset of this fragment in the reassembled payload. */
+    uint32_t                            offFrag;
+    /** Size of the fragment data following in bytes. */
+    uint32_t                            cbFrag;
+} PSPSERIALFRAGREQ;
+/** Pointer to request fragment header. */
+typedef PSPSERIALFRAGREQ *PPSPSERIALFRAGREQ;
+/** Pointer to a const request fragment header. */
+typedef const PSPSERIALFRAGREQ *PCPSPSERIALFRAGREQ;
+
+#ifdef __GNUC__
+_Static_assert(sizeof(PSPSERIALFRAGREQ) == 24, "Fragment descriptor has invalid size!");
+#endif
+
+/** Size of the link test pattern payload in bytes. */
+#define PSP_SERIAL_LINK_TEST_PATTERN_SIZE           256
+/** Returns the byte at the given offset in the link test pattern, every value 0..127 is directly followed by its
+ * complement, so the 256 byte pattern contains all byte values and toggles every data bit between adjacent bytes. */
+#define PSP_SERIAL_LINK_TEST_PATTERN_GET(a_off)     ((a_off) & 1 ? (uint8_t)~((a_off) >> 1) : (uint8_t)((a_off) >> 1))
+
+
 /**
  * PSP serial stub output buffer notification data.
  */
@@ -303,6 +573,37 @@ typedef PSPSERIALOUTBUFNOT *PPSPSERIALOUTBUFNOT;
 typedef const PSPSERIALOUTBUFNOT *PCPSPSERIALOUTBUFNOT;
 
 
+/**
+ * PSP serial stub output ring notification data.
+ *
+ * Followed by the data drained from the ring. The indices describe the ring state after the data was taken,
+ * so the external side can see how far the module is ahead and throttle it through an input buffer if required.
+ */
+typedef struct PSPSERIALOUTBUFRINGNOT
+{
+    /** Output buffer identifer. */
+    uint32_t                            idOutBuf;
+    /** PSP address of the ring header (CMOUTRING). */
+    PSPADDR                             PspAddrRing;
+    /** Producer index of the ring. */
+    uint32_t                            offProducer;
+    /** Consumer index of the ring, including the data in this notification. */
+    uint32_t                            offConsumer;
+    /** Size of the ring data area in bytes. */
+    uint32_t                            cbData;
+    /** Number of bytes dropped so far because the ring was full. */
+    uint32_t                            cbDropped;
+} PSPSERIALOUTBUFRINGNOT;
+/** Pointer to output ring notification data. */
+typedef PSPSERIALOUTBUFRINGNOT *PPSPSERIALOUTBUFRINGNOT;
+/** Pointer to a const output ring notification. */
+typedef const PSPSERIALOUTBUFRINGNOT *PCPSPSERIALOUTBUFRINGNOT;
+
+#ifdef __GNUC__
+_Static_assert(sizeof(PSPSERIALOUTBUFRINGNOT) == 24, "Output ring notification has invalid size!");
+#endif
+
+
 /**
  * PSP serial stub code module execution done notification data.
  */
@@ -319,6 +620,23 @@ typedef PSPSERIALEXECCMFINISHEDNOT *PPSPSERIALEXECCMFINISHEDNOT;
 typedef const PSPSERIALEXECCMFINISHEDNOT *PCPSPSERIALEXECCMFINISHEDNOT;
 
 
+/**
+ * PSP serial stub connect request data (optional, a connect request without payload
+ * negotiates no features and results in the legacy stop-and-wait mode).
+ */
+typedef struct PSPSERIALCONNECTREQ
+{
+    /** Features the external side wants to use, PSP_SERIAL_CONNECT_F_XXX. */
+    uint32_t                            fFeatures;
+    /** Maximum number of requests the external side wants to have in flight (pipelining only). */
+    uint32_t                            cReqsInFlightMax;
+} PSPSERIALCONNECTREQ;
+/** Pointer to connect request data. */
+typedef PSPSERIALCONNECTREQ *PPSPSERIALCONNECTREQ;
+/** Pointer to a const connect request. */
+typedef const PSPSERIALCONNECTREQ *PCPSPSERIALCONNECTREQ;
+
+
 /**
  * PSP serial stub connect response data.
  */
@@ -326,22 +644,91 @@ typedef struct PSPSERIALCONNECTRESP
 {
     /** Maximum PDU length supported. */
     uint32_t                            cbPduMax;
-    /** Size of the scratch space area in bytes. */
+    /** Size of the scratch space area in bytes (only the host managed part if a PSPSERIALCONNECTRESPSCRATCH follows). */
     uint32_t                            cbScratch;
-    /** Start address of the scratch space area. */
+    /** Start address of the scratch space area (only the host managed part if a PSPSERIALCONNECTRESPSCRATCH follows). */
     PSPADDR                             PspAddrScratch;
     /** Number of sockets in the system. */
     uint32_t                            cSysSockets;
     /** Number of CCDs in the systems */
     uint32_t                            cCcdsPerSocket;
-    /** Padding to 8 byte alignment. */
-    uint32_t                            au32Pad0;
+    /** Features the stub agreed to use, subset of the requested ones, PSP_SERIAL_CONNECT_F_XXX. */
+    uint32_t                            fFeatures;
+    /** Maximum number of requests the external side is allowed to have in flight (window size),
+     * 1 if pipelining was not negotiated. */
+    uint32_t                            cReqsInFlightMax;
+    /** Frequency of the cycle counter used for PSPSERIALPDUHDREXT::tsCycles in kHz, 0 if there is none. */
+    uint32_t                            u32CycleFreqKHz;
 } PSPSERIALCONNECTRESP;
 /** Pointer to connect response data. */
 typedef PSPSERIALCONNECTRESP *PPSPSERIALCONNECTRESP;
 /** Pointer to a const connect response. */
 typedef const PSPSERIALCONNECTRESP *PCPSPSERIALCONNECTRESP;
 
+#ifdef __GNUC__
+_Static_assert(sizeof(PSPSERIALCONNECTRESP) == 32, "Connect response has invalid size!");
+#endif
+
+/** Pipelined request mode, the external side may have up to PSPSERIALCONNECTRESP::cReqsInFlightMax requests
+ * in flight and matches the responses using PSPSERIALPDUHDR::cPdusReq. Responses are still sent in request order.
+ * Lost or corrupted request PDUs are recovered go-back-N style, see PSPSERIALREQGAPNOT. */
+#define PSP_SERIAL_CONNECT_F_PIPELINING                 BIT(0)
+/** Run length encoded payloads for generic data transfers (PSP_SERIAL_DATA_XFER_F_COMPRESSED). */
+#define PSP_SERIAL_CONNECT_F_COMPRESSION_RLE            BIT(1)
+/** Notifications are queued in a ring and coalesced by the stub: interrupt state transitions are merged
+ * and log messages are batched into a single PDU up to the maximum PDU size. The payload of a
+ * PSPSERIALPDURRNID_NOTIFICATION_LOG_MSG then consists of one or more messages packed back to back, each terminated
+ * by a zero byte (a message never contains one), so a PDU with n terminators merged n - 1 messages. */
+#define PSP_SERIAL_CONNECT_F_NOT_COALESCING             BIT(2)
+/** The link speed can be changed after connecting with PSPSERIALPDURRNID_REQUEST_LINK_CFG_SET. */
+#define PSP_SERIAL_CONNECT_F_LINK_CFG                   BIT(3)
+/** Requests larger than the maximum PDU size can be sent with PSPSERIALPDURRNID_REQUEST_FRAGMENT. */
+#define PSP_SERIAL_CONNECT_F_FRAGMENTATION              BIT(4)
+/** Requests can be executed on several CCDs at once with PSPSERIALPDURRNID_REQUEST_CCD_FANOUT. */
+#define PSP_SERIAL_CONNECT_F_CCD_FANOUT                 BIT(5)
+/** Loaded code modules are cached in a reserved part of the scratch space, see PSPSERIALPDURRNID_REQUEST_LOAD_CODE_MOD_CACHED. */
+#define PSP_SERIAL_CONNECT_F_CM_CACHE                   BIT(6)
+/** Every response and notification payload after the connect response starts with a PSPSERIALPDUHDREXT. */
+#define PSP_SERIAL_CONNECT_F_HDR_EXT                    BIT(7)
+/** Per segment CRCs for generic data transfer reads (PSP_SERIAL_DATA_XFER_F_SEG_CRC) and selective retransmission
+ * with PSPSERIALPDURRNID_REQUEST_PSP_DATA_XFER_NACK. */
+#define PSP_SERIAL_CONNECT_F_XFER_SEG_CRC               BIT(8)
+/** On stub data checks: PSP_SERIAL_DATA_XFER_F_CRC32, PSP_SERIAL_DATA_XFER_F_VERIFY and
+ * PSPSERIALPDURRNID_REQUEST_PSP_DATA_SEARCH. */
+#define PSP_SERIAL_CONNECT_F_XFER_CHECK                 BIT(9)
+/** Set by the stub (never requested) if the stub is a software simulator and not real hardware,
+ * memory contents and timings are emulated. */
+#define PSP_SERIAL_CONNECT_F_SIMULATED                  ((uint32_t)1 << 31)
+
+
+/**
+ * PSP serial stub scratch space partitioning, follows PSPSERIALCONNECTRESP if PSP_SERIAL_CONNECT_F_FRAGMENTATION
+ * or PSP_SERIAL_CONNECT_F_CM_CACHE was negotiated.
+ *
+ * The stub reserves the reassembly area and the code module cache area at the end of the scratch space, both are
+ * disjoint and PSPSERIALCONNECTRESP::PspAddrScratch and cbScratch only describe the remaining part managed by the host.
+ * The host must not write to the reserved areas. An area which is not used has a size of 0.
+ */
+typedef struct PSPSERIALCONNECTRESPSCRATCH
+{
+    /** Start address of the request fragment reassembly area. */
+    PSPADDR                             PspAddrReasm;
+    /** Size of the request fragment reassembly area in bytes. */
+    uint32_t                            cbReasm;
+    /** Start address of the code module cache area. */
+    PSPADDR                             PspAddrCmCache;
+    /** Size of the code module cache area in bytes. */
+    uint32_t                            cbCmCache;
+} PSPSERIALCONNECTRESPSCRATCH;
+/** Pointer to scratch space partitioning data. */
+typedef PSPSERIALCONNECTRESPSCRATCH *PPSPSERIALCONNECTRESPSCRATCH;
+/** Pointer to const scratch space partitioning data. */
+typedef const PSPSERIALCONNECTRESPSCRATCH *PCPSPSERIALCONNECTRESPSCRATCH;
+
+#ifdef __GNUC__
+_Static_assert(sizeof(PSPSERIALCONNECTRESPSCRATCH) == 16, "Scratch space partitioning has invalid size!");
+#endif
+
 
 /**
  * PSP memory transfer request (SRAM and MMIO).
@@ -359,6 +746,32 @@ typedef PSPSERIALPSPMEMXFERREQ *PPSPSERIALPSPMEMXFERREQ;
 typedef const PSPSERIALPSPMEMXFERREQ *PCPSPSERIALPSPMEMXFERREQ;
 
 
+/**
+ * PSP memory blockwise hash request.
+ *
+ * The response payload contains one CRC32 (see PSP_SERIAL_CRC32_POLY) for every block in the range,
+ * padded to the next 8 byte alignment. The host can compare them against a previous snapshot
+ * and read only the blocks which changed.
+ */
+typedef struct PSPSERIALPSPMEMHASHREQ
+{
+    /** The range to hash, cbXfer must be a multiple of the block size. */
+    PSPSERIALPSPMEMXFERREQ              Xfer;
+    /** Size of a single block in bytes. */
+    uint32_t                            cbBlock;
+    /** Padding to 8 byte alignment. */
+    uint32_t                            u32Pad0;
+} PSPSERIALPSPMEMHASHREQ;
+/** Pointer to a PSP memory hash request. */
+typedef PSPSERIALPSPMEMHASHREQ *PPSPSERIALPSPMEMHASHREQ;
+/** Pointer to a const PSP memory hash request. */
+typedef const PSPSERIALPSPMEMHASHREQ *PCPSPSERIALPSPMEMHASHREQ;
+
+/** The reflected CRC32 polynomial (IEEE 802.3) used for all hashes in the protocol,
+ * initial value and final XOR are 0xffffffff (same as zlib's crc32()). */
+#define PSP_SERIAL_CRC32_POLY                       ((uint32_t)0xedb88320)
+
+
 /**
  * SMN memory transfer request.
  */
@@ -425,6 +838,99 @@ typedef PSPSERIALLOADCODEMODREQ *PPSPSERIALLOADCODEMODREQ;
 typedef const PSPSERIALLOADCODEMODREQ *PCPSPSERIALLOADCODEMODREQ;
 
 
+/**
+ * PSP serial stub ELF code module descriptor, follows PSPSERIALLOADCODEMODREQ for PSPSERIALCMTYPE_ELF.
+ *
+ * The descriptor is followed by cRelocs 32bit offsets relative to PspAddrLoad, padded to the next 8 byte alignment.
+ * The host converts all R_ARM_RELATIVE and R_ARM_ABS32 relocations against the image into these offsets.
+ * The stub adds PspAddrLoad - PspAddrLink to every 32bit word referenced, flushes the caches for the image
+ * and uses PspAddrLoad + offEntry as the entry point for PSPSERIALPDURRNID_REQUEST_EXEC_CODE_MOD.
+ */
+typedef struct PSPSERIALLOADCODEMODELF
+{
+    /** PSP address the segments were written to (lowest segment virtual address relocated), must be in the host managed scratch space. */
+    PSPADDR                             PspAddrLoad;
+    /** Address the image was linked at (lowest segment virtual address). */
+    PSPADDR                             PspAddrLink;
+    /** Size of the image in memory in bytes (including BSS). */
+    uint32_t                            cbImage;
+    /** Offset of the entry point from PspAddrLoad. */
+    uint32_t                            offEntry;
+    /** Number of relocation offsets following. */
+    uint32_t                            cRelocs;
+    /** Flags, PSP_SERIAL_LOAD_CODE_MOD_ELF_F_XXX. */
+    uint32_t                            fFlags;
+} PSPSERIALLOADCODEMODELF;
+/** Pointer to an ELF code module descriptor. */
+typedef PSPSERIALLOADCODEMODELF *PPSPSERIALLOADCODEMODELF;
+/** Pointer to a const ELF code module descriptor. */
+typedef const PSPSERIALLOADCODEMODELF *PCPSPSERIALLOADCODEMODELF;
+
+#ifdef __GNUC__
+_Static_assert(sizeof(PSPSERIALLOADCODEMODELF) == 24, "ELF code module descriptor has invalid size!");
+#endif
+
+/** The entry point uses the thumb instruction set (bit 0 of e_entry was set). */
+#define PSP_SERIAL_LOAD_CODE_MOD_ELF_F_THUMB    BIT(0)
+
+
+/**
+ * PSP serial stub cached load code module request data.
+ *
+ * The header is followed by the same payload a PSPSERIALPDURRNID_REQUEST_LOAD_CODE_MOD request carries after its
+ * PSPSERIALLOADCODEMODREQ, or by nothing at all to only look the module up. If a module with the given hash is cached
+ * it becomes the current code module and the payload is ignored. Otherwise the module is loaded from the payload
+ * and added to the cache, or PSP_SERIAL_STS_ERR_NOT_FOUND is returned if there is no payload.
+ *
+ * The cache keeps a copy of up to PSP_SERIAL_CM_CACHE_ENTRIES_MAX loaded modules in the code module cache area
+ * (PSPSERIALCONNECTRESPSCRATCH), the least recently used modules are evicted if there is not enough room left.
+ * On a hit the copy is restored to where the module executes, for PSPSERIALCMTYPE_FLAT_BINARY that is
+ * CM_FLAT_BINARY_LOAD_ADDR and for PSPSERIALCMTYPE_ELF the already relocated image goes to its original
+ * PSPSERIALLOADCODEMODELF::PspAddrLoad, overwriting whatever the host placed there in the meantime.
+ */
+typedef struct PSPSERIALLOADCODEMODCACHEDREQ
+{
+    /** Hash of the module content identifying the cache entry (computed by the host, opaque to the stub). */
+    uint8_t                             abHash[32];
+    /** The load request. */
+    PSPSERIALLOADCODEMODREQ             LoadReq;
+} PSPSERIALLOADCODEMODCACHEDREQ;
+/** Pointer to cached load code module request data. */
+typedef PSPSERIALLOADCODEMODCACHEDREQ *PPSPSERIALLOADCODEMODCACHEDREQ;
+/** Pointer to a const cached load code module request. */
+typedef const PSPSERIALLOADCODEMODCACHEDREQ *PCPSPSERIALLOADCODEMODCACHEDREQ;
+
+#ifdef __GNUC__
+_Static_assert(sizeof(PSPSERIALLOADCODEMODCACHEDREQ) == 40, "Cached load code module descriptor has invalid size!");
+#endif
+
+/** Maximum number of code modules in the cache. */
+#define PSP_SERIAL_CM_CACHE_ENTRIES_MAX         8
+
+
+/**
+ * PSP serial stub cached load code module response data.
+ */
+typedef struct PSPSERIALLOADCODEMODCACHEDRESP
+{
+    /** Flags, PSP_SERIAL_CM_CACHE_F_XXX. */
+    uint32_t                            fFlags;
+    /** Number of modules in the cache afterwards. */
+    uint32_t                            cEntries;
+    /** Number of bytes of the code module cache area occupied afterwards. */
+    uint32_t                            cbUsed;
+    /** Number of modules evicted to make room for this one. */
+    uint32_t                            cEvicted;
+} PSPSERIALLOADCODEMODCACHEDRESP;
+/** Pointer to cached load code module response data. */
+typedef PSPSERIALLOADCODEMODCACHEDRESP *PPSPSERIALLOADCODEMODCACHEDRESP;
+/** Pointer to a const cached load code module response. */
+typedef const PSPSERIALLOADCODEMODCACHEDRESP *PCPSPSERIALLOADCODEMODCACHEDRESP;
+
+/** The module was found in the cache. */
+#define PSP_SERIAL_CM_CACHE_F_HIT               BIT(0)
+
+
 /**
  * PSP serial stub exec code module request data.
  */
@@ -456,7 +962,8 @@ typedef struct PSPSERIALDATAXFERREQ
     uint32_t                            cbStride;
     /** Size of the transfer in bytes (must be multiple of access stride). */
     uint32_t                            cbXfer;
-    /** Transfer flags. */
+    /** Transfer flags, PSP_SERIAL_DATA_XFER_F_XXX. A stub rejects any flag it doesn't know or which requires
+     * a feature that was not negotiated with PSP_SERIAL_STS_ERR_INVALID_PARAMETER without accessing the target. */
     uint32_t                            fFlags;
     /** The address space dependent start address of the transfer. */
     union
@@ -494,6 +1001,277 @@ _Static_assert(sizeof(PSPSERIALDATAXFERREQ) == 32, "Memory transfer descriptor h
 #define PSP_SERIAL_DATA_XFER_F_MEMSET    BIT(2)
 /** Increment PSP address after each access by the stride. */
 #define PSP_SERIAL_DATA_XFER_F_INCR_ADDR BIT(3)
+/** The transfer data in the request (write) or response (read) payload is run length encoded,
+ * requires PSP_SERIAL_CONNECT_F_COMPRESSION_RLE, cbXfer still denotes the uncompressed size. */
+#define PSP_SERIAL_DATA_XFER_F_COMPRESSED BIT(4)
+/** The read data in the response is protected by per segment CRC32 values (see PSP_SERIAL_DATA_XFER_SEG_SIZE),
+ * requires PSP_SERIAL_CONNECT_F_XFER_SEG_CRC. The response payload starts with one CRC32 per segment padded to the
+ * next 8 byte alignment, followed by the data. Corrupted segments can be requested again with
+ * PSPSERIALPDURRNID_REQUEST_PSP_DATA_XFER_NACK. */
+#define PSP_SERIAL_DATA_XFER_F_SEG_CRC   BIT(5)
+/** Read the range but return only its CRC32 (see PSP_SERIAL_CRC32_POLY) as a single 32bit value padded
+ * to the next 8 byte alignment instead of the data, requires PSP_SERIAL_DATA_XFER_F_READ and
+ * PSP_SERIAL_CONNECT_F_XFER_CHECK. */
+#define PSP_SERIAL_DATA_XFER_F_CRC32     BIT(6)
+/** Compare the range against the request payload, a direction of its own which must not be combined with
+ * PSP_SERIAL_DATA_XFER_F_READ or PSP_SERIAL_DATA_XFER_F_WRITE and requires PSP_SERIAL_CONNECT_F_XFER_CHECK.
+ * The payload has the same layout as for a write (can be combined with PSP_SERIAL_DATA_XFER_F_MEMSET and
+ * PSP_SERIAL_DATA_XFER_F_COMPRESSED). The response payload contains the 32bit offset of the first differing byte
+ * or PSP_SERIAL_DATA_XFER_VERIFY_MATCH, padded to the next 8 byte alignment. Nothing is written to the target. */
+#define PSP_SERIAL_DATA_XFER_F_VERIFY    BIT(7)
+
+/** Offset returned by PSP_SERIAL_DATA_XFER_F_VERIFY if the whole range matches. */
+#define PSP_SERIAL_DATA_XFER_VERIFY_MATCH UINT32_MAX
+
+/** Size of a segment protected by its own CRC32. */
+#define PSP_SERIAL_DATA_XFER_SEG_SIZE    _1K
+/** Returns the number of segments for the given transfer size. */
+#define PSP_SERIAL_DATA_XFER_SEG_COUNT(a_cbXfer) (((a_cbXfer) + PSP_SERIAL_DATA_XFER_SEG_SIZE - 1) / PSP_SERIAL_DATA_XFER_SEG_SIZE)
+
+/** @name Run length encoding used for compressed transfers.
+ *
+ * The stream consists of records starting with a control byte. If the run bit is set
+ * the next byte is repeated PSP_SERIAL_RLE_CTRL_RUN_LEN_GET() times, otherwise
+ * PSP_SERIAL_RLE_CTRL_LIT_LEN_GET() literal bytes follow.
+ * @{ */
+/** The record is a run of a single repeated byte. */
+#define PSP_SERIAL_RLE_CTRL_RUN                     BIT(7)
+/** Minimum length of a run, shorter runs are encoded as literals. */
+#define PSP_SERIAL_RLE_RUN_LEN_MIN                  3
+/** Maximum length of a run. */
+#define PSP_SERIAL_RLE_RUN_LEN_MAX                  (0x7f + PSP_SERIAL_RLE_RUN_LEN_MIN)
+/** Maximum number of literal bytes in one record. */
+#define PSP_SERIAL_RLE_LIT_LEN_MAX                  (0x7f + 1)
+/** Returns the run length from the given control byte. */
+#define PSP_SERIAL_RLE_CTRL_RUN_LEN_GET(a_bCtrl)    (((a_bCtrl) & 0x7f) + PSP_SERIAL_RLE_RUN_LEN_MIN)
+/** Returns the number of literal bytes from the given control byte. */
+#define PSP_SERIAL_RLE_CTRL_LIT_LEN_GET(a_bCtrl)    (((a_bCtrl) & 0x7f) + 1)
+/** Creates a run control byte for the given run length. */
+#define PSP_SERIAL_RLE_CTRL_RUN_MAKE(a_cbRun)       ((uint8_t)(PSP_SERIAL_RLE_CTRL_RUN | ((a_cbRun) - PSP_SERIAL_RLE_RUN_LEN_MIN)))
+/** Creates a literal control byte for the given number of literal bytes. */
+#define PSP_SERIAL_RLE_CTRL_LIT_MAKE(a_cbLit)       ((uint8_t)((a_cbLit) - 1))
+/** @} */
+
+
+/**
+ * Batch request header.
+ *
+ * The header is followed by cOps PSPSERIALDATAXFERREQ descriptors which get executed in order.
+ * The data for all write and memset descriptors follows the descriptor array in descriptor order,
+ * each datum padded to the next 8 byte alignment.
+ */
+typedef struct PSPSERIALBATCHREQ
+{
+    /** Number of transfer descriptors following. */
+    uint32_t                            cOps;
+    /** Flags controlling the batch execution, PSP_SERIAL_BATCH_F_XXX. */
+    uint32_t                            fFlags;
+} PSPSERIALBATCHREQ;
+/** Pointer to a batch request header. */
+typedef PSPSERIALBATCHREQ *PPSPSERIALBATCHREQ;
+/** Pointer to a const batch request header. */
+typedef const PSPSERIALBATCHREQ *PCPSPSERIALBATCHREQ;
+
+/** Stop executing the batch at the first failing descriptor, the remaining ones are reported with
+ * PSP_SERIAL_STS_ERR_BATCH_SKIPPED. */
+#define PSP_SERIAL_BATCH_F_STOP_ON_ERROR    BIT(0)
+
+
+/**
+ * Batch response per descriptor status.
+ *
+ * The response payload consists of a PSPSERIALBATCHREQ header, where cOps always equals the cOps of the request
+ * (the flags are echoed as well), followed by one of these for every descriptor in request order. Descriptors which were
+ * not executed because of PSP_SERIAL_BATCH_F_STOP_ON_ERROR carry PSP_SERIAL_STS_ERR_BATCH_SKIPPED. For successful read
+ * descriptors the status is directly followed by the read data, padded to the next 8 byte alignment.
+ */
+typedef struct PSPSERIALBATCHOPSTS
+{
+    /** Status code of the operation. */
+    PSPSTS                              rcOp;
+    /** Number of data bytes following (0 for anything but successful reads). */
+    uint32_t                            cbData;
+} PSPSERIALBATCHOPSTS;
+/** Pointer to a batch operation status. */
+typedef PSPSERIALBATCHOPSTS *PPSPSERIALBATCHOPSTS;
+/** Pointer to a const batch operation status. */
+typedef const PSPSERIALBATCHOPSTS *PCPSPSERIALBATCHOPSTS;
+
+
+/**
+ * Selective retransmission request header.
+ *
+ * Repeats the original read transfer descriptor (the stub keeps no state between requests) and is followed
+ * by cSegs 32bit segment indices, padded to the next 8 byte alignment. The response payload has the same layout as
+ * a PSP_SERIAL_DATA_XFER_F_SEG_CRC response, containing only the requested segments in the given order.
+ */
+typedef struct PSPSERIALDATAXFERNACKREQ
+{
+    /** The original transfer descriptor. */
+    PSPSERIALDATAXFERREQ                XferReq;
+    /** Number of segment indices following. */
+    uint32_t                            cSegs;
+    /** Padding to 8 byte alignment. */
+    uint32_t                            u32Pad0;
+} PSPSERIALDATAXFERNACKREQ;
+/** Pointer to a selective retransmission request header. */
+typedef PSPSERIALDATAXFERNACKREQ *PPSPSERIALDATAXFERNACKREQ;
+/** Pointer to a const selective retransmission request header. */
+typedef const PSPSERIALDATAXFERNACKREQ *PCPSPSERIALDATAXFERNACKREQ;
+
+
+/**
+ * Scatter/gather data transfer request header.
+ *
+ * The header is followed by cSegs PSPSERIALDATAXFERREQ segment descriptors, each naming its own address space,
+ * address, stride and length. Unlike a batch the data of all segments is packed back to back in segment order
+ * without any padding in between (write: following the descriptors, read: the response payload), so the result
+ * is byte for byte identical to issuing the segments as single generic data transfers and concatenating the data.
+ * The transfer is aborted at the first failing segment.
+ */
+typedef struct PSPSERIALDATAXFERSGREQ
+{
+    /** Number of segment descriptors following. */
+    uint32_t                            cSegs;
+    /** Transfer direction, either PSP_SERIAL_DATA_XFER_F_READ or PSP_SERIAL_DATA_XFER_F_WRITE,
+     * the segment descriptors must use the same direction. */
+    uint32_t                            fFlags;
+} PSPSERIALDATAXFERSGREQ;
+/** Pointer to a scatter/gather data transfer request header. */
+typedef PSPSERIALDATAXFERSGREQ *PPSPSERIALDATAXFERSGREQ;
+/** Pointer to a const scatter/gather data transfer request header. */
+typedef const PSPSERIALDATAXFERSGREQ *PCPSPSERIALDATAXFERSGREQ;
+
+
+/**
+ * CCD fan-out request header.
+ *
+ * The header is followed by the payload of the wrapped request. The master stub (the one the PDU is addressed to
+ * through PSPSERIALPDUHDR::idCcd) forwards the request to all selected CCDs (SVC_CALL_OTHER_PSP style), executes
+ * it locally if selected as well and waits until all CCDs are done. The CCD ID is socket * cCcdsPerSocket + die,
+ * see PSPSERIALCONNECTRESP. Only requests without state on the stub (memory, MMIO, SMN, coprocessor accesses,
+ * generic data transfers and batches) can be wrapped.
+ *
+ * The response payload consists of a PSPSERIALCCDFANOUTRESP header followed by one PSPSERIALCCDFANOUTSTS for every
+ * selected CCD in ascending CCD ID order, each directly followed by the response payload of the wrapped request padded
+ * to the next 8 byte alignment. The stub computes the maximum response size before dispatching anything, if it exceeds
+ * PSPSERIALCONNECTRESP::cbPduMax the whole request fails with PSP_SERIAL_STS_ERR_BUFFER_OVERFLOW and no CCD executes
+ * the wrapped request (the host has to split the CCD set or the wrapped request).
+ */
+typedef struct PSPSERIALCCDFANOUTREQ
+{
+    /** Bitmap of CCD IDs to execute the request on. */
+    uint64_t                            bmCcds;
+    /** The request ID of the wrapped request. */
+    PSPSERIALPDURRNID                   enmRrnIdReq;
+    /** Size of the wrapped request payload following in bytes. */
+    uint32_t                            cbReq;
+} PSPSERIALCCDFANOUTREQ;
+/** Pointer to a CCD fan-out request header. */
+typedef PSPSERIALCCDFANOUTREQ *PPSPSERIALCCDFANOUTREQ;
+/** Pointer to a const CCD fan-out request header. */
+typedef const PSPSERIALCCDFANOUTREQ *PCPSPSERIALCCDFANOUTREQ;
+
+#ifdef __GNUC__
+_Static_assert(sizeof(PSPSERIALCCDFANOUTREQ) == 16, "CCD fan-out descriptor has invalid size!");
+#endif
+
+/** Maximum number of CCDs which can be addressed by a single fan-out request. */
+#define PSP_SERIAL_CCD_FANOUT_CCDS_MAX      64
+
+
+/**
+ * CCD fan-out response header.
+ */
+typedef struct PSPSERIALCCDFANOUTRESP
+{
+    /** Bitmap of CCD IDs which executed the wrapped request (a selected CCD which could not be reached
+     * is missing here but still has a status entry with the error). */
+    uint64_t                            bmCcdsExecuted;
+    /** Number of PSPSERIALCCDFANOUTSTS entries following (number of bits set in PSPSERIALCCDFANOUTREQ::bmCcds). */
+    uint32_t                            cCcds;
+    /** Padding to 8 byte alignment. */
+    uint32_t                            u32Pad0;
+} PSPSERIALCCDFANOUTRESP;
+/** Pointer to a CCD fan-out response header. */
+typedef PSPSERIALCCDFANOUTRESP *PPSPSERIALCCDFANOUTRESP;
+/** Pointer to a const CCD fan-out response header. */
+typedef const PSPSERIALCCDFANOUTRESP *PCPSPSERIALCCDFANOUTRESP;
+
+#ifdef __GNUC__
+_Static_assert(sizeof(PSPSERIALCCDFANOUTRESP) == 16, "CCD fan-out response header has invalid size!");
+#endif
+
+
+/**
+ * CCD fan-out response per CCD status.
+ */
+typedef struct PSPSERIALCCDFANOUTSTS
+{
+    /** The CCD ID the status belongs to. */
+    uint32_t                            idCcd;
+    /** Status code of the wrapped request on that CCD. */
+    PSPSTS                              rcReq;
+    /** Number of response bytes following (excluding the padding). */
+    uint32_t                            cbResp;
+    /** Padding to 8 byte alignment. */
+    uint32_t                            u32Pad0;
+} PSPSERIALCCDFANOUTSTS;
+/** Pointer to a CCD fan-out status. */
+typedef PSPSERIALCCDFANOUTSTS *PPSPSERIALCCDFANOUTSTS;
+/** Pointer to a const CCD fan-out status. */
+typedef const PSPSERIALCCDFANOUTSTS *PCPSPSERIALCCDFANOUTSTS;
+
+
+/**
+ * Pattern search request header, requires PSP_SERIAL_CONNECT_F_XFER_CHECK.
+ *
+ * The range given by the read transfer descriptor is searched for the pattern of cbPattern bytes following
+ * the header (padded to the next 8 byte alignment). Only offsets which are a multiple of cbAlign are checked,
+ * a pattern may span stride sized accesses. The response payload consists of a PSPSERIALDATASEARCHRESP followed by
+ * the 32bit offsets of the matches relative to the start of the range in ascending order, padded to the next
+ * 8 byte alignment.
+ */
+typedef struct PSPSERIALDATASEARCHREQ
+{
+    /** The range to search. */
+    PSPSERIALDATAXFERREQ                XferReq;
+    /** Size of the pattern following in bytes. */
+    uint32_t                            cbPattern;
+    /** Alignment of the offsets to check in bytes (1 to check every offset). */
+    uint32_t                            cbAlign;
+    /** Maximum number of matches to return. */
+    uint32_t                            cMatchesMax;
+    /** Padding to 8 byte alignment. */
+    uint32_t                            u32Pad0;
+} PSPSERIALDATASEARCHREQ;
+/** Pointer to a pattern search request header. */
+typedef PSPSERIALDATASEARCHREQ *PPSPSERIALDATASEARCHREQ;
+/** Pointer to a const pattern search request header. */
+typedef const PSPSERIALDATASEARCHREQ *PCPSPSERIALDATASEARCHREQ;
+
+#ifdef __GNUC__
+_Static_assert(sizeof(PSPSERIALDATASEARCHREQ) == 48, "Pattern search descriptor has invalid size!");
+#endif
+
+
+/**
+ * Pattern search response header.
+ */
+typedef struct PSPSERIALDATASEARCHRESP
+{
+    /** Number of match offsets following. */
+    uint32_t                            cMatches;
+    /** Flags, PSP_SERIAL_DATA_SEARCH_F_XXX. */
+    uint32_t                            fFlags;
+} PSPSERIALDATASEARCHRESP;
+/** Pointer to a pattern search response header. */
+typedef PSPSERIALDATASEARCHRESP *PPSPSERIALDATASEARCHRESP;
+/** Pointer to a const pattern search response header. */
+typedef const PSPSERIALDATASEARCHRESP *PCPSPSERIALDATASEARCHRESP;
+
+/** The search stopped after cMatchesMax matches, there might be more in the remaining range. */
+#define PSP_SERIAL_DATA_SEARCH_F_TRUNCATED  BIT(0)
 
 
 /**
@@ -0,0 +1,117 @@
+/** @file
+ * PSP serial stub - PDU trace file format.
+ */
+
+/*
+ * Copyright (C) 2020 Alexander Eichner <alexander.eichner@campus.tu-berlin.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __include_psp_serial_trace_h
+#define __include_psp_serial_trace_h
+
+#include <psp-stub/psp-serial-stub.h>
+
+/* Everything is little endian here. */
+
+/** Trace file header magic. */
+#define PSP_SERIAL_TRACE_HDR_MAGIC                      ((uint32_t)0x43525450) /* PTRC */
+/** Current trace file format version. */
+#define PSP_SERIAL_TRACE_HDR_VERSION                    1
+/** Trace record magic. */
+#define PSP_SERIAL_TRACE_REC_MAGIC                      ((uint32_t)0x44525450) /* PTRD */
+
+
+/**
+ * PDU trace file header.
+ */
+typedef struct PSPSERIALTRACEHDR
+{
+    /** Identifying magic, PSP_SERIAL_TRACE_HDR_MAGIC. */
+    uint32_t                            u32Magic;
+    /** Format version, PSP_SERIAL_TRACE_HDR_VERSION. */
+    uint32_t                            u32Version;
+    /** Size of the header in bytes, records start right after it. */
+    uint32_t                            cbHdr;
+    /** The link baud rate when the trace started (for link utilization calculations). */
+    uint32_t                            u32BaudRate;
+    /** Host wall clock timestamp in nanoseconds since the epoch when the trace started. */
+    uint64_t                            tsStartNano;
+} PSPSERIALTRACEHDR;
+/** Pointer to a PDU trace file header. */
+typedef PSPSERIALTRACEHDR *PPSPSERIALTRACEHDR;
+/** Pointer to a const PDU trace file header. */
+typedef const PSPSERIALTRACEHDR *PCPSPSERIALTRACEHDR;
+
+#ifdef __GNUC__
+_Static_assert(sizeof(PSPSERIALTRACEHDR) == 24, "Trace file header has invalid size!");
+#endif
+
+
+/**
+ * PDU direction.
+ */
+typedef enum PSPSERIALTRACEDIR
+{
+    /** Invalid direction. */
+    PSPSERIALTRACEDIR_INVALID = 0,
+    /** PDU sent from the external side to the PSP. */
+    PSPSERIALTRACEDIR_EXT_2_PSP,
+    /** PDU sent from the PSP to the external side. */
+    PSPSERIALTRACEDIR_PSP_2_EXT,
+    /** 32bit hack. */
+    PSPSERIALTRACEDIR_32BIT_HACK = 0x7fffffff
+} PSPSERIALTRACEDIR;
+
+
+/**
+ * PDU trace record.
+ *
+ * The record is followed by cbWire bytes containing the PDU exactly as it was seen on the wire
+ * (header, payload, padding and footer), padded to the next 8 byte alignment. The PDU header
+ * provides the counter, request ID, payload size and stub timestamp.
+ */
+typedef struct PSPSERIALTRACEREC
+{
+    /** Identifying magic, PSP_SERIAL_TRACE_REC_MAGIC. */
+    uint32_t                            u32Magic;
+    /** Direction of the PDU. */
+    PSPSERIALTRACEDIR                   enmDir;
+    /** Host timestamp in nanoseconds relative to PSPSERIALTRACEHDR::tsStartNano when the
+     * first byte of the PDU was sent or received. */
+    uint64_t                            tsFirstByteNano;
+    /** Host timestamp in nanoseconds relative to PSPSERIALTRACEHDR::tsStartNano when the
+     * last byte of the PDU was sent or received. */
+    uint64_t                            tsLastByteNano;
+    /** Size of the PDU following in bytes as seen on the wire (PSP_SERIAL_PDU_SIZE_TOTAL(), not
+     * PSPSERIALPDUHDR::cbPdu which excludes header and footer). */
+    uint32_t                            cbWire;
+    /** Padding to 8 byte alignment. */
+    uint32_t                            u32Pad0;
+} PSPSERIALTRACEREC;
+/** Pointer to a PDU trace record. */
+typedef PSPSERIALTRACEREC *PPSPSERIALTRACEREC;
+/** Pointer to a const PDU trace record. */
+typedef const PSPSERIALTRACEREC *PCPSPSERIALTRACEREC;
+
+#ifdef __GNUC__
+_Static_assert(sizeof(PSPSERIALTRACEREC) == 32, "Trace record has invalid size!");
+#endif
+
+#endif /* !__include_psp_serial_trace_h */
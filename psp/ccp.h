@@ -54,6 +54,8 @@
 #define CCP_V5_ENGINE_ZLIB_DECOMP                   6
 /** ECC engine. */
 #define CCP_V5_ENGINE_ECC                           7
+/** Number of engines. */
+#define CCP_V5_ENGINE_COUNT                         8
 /** Return the engine from the given dword. */
 #define CCP_V5_ENGINE_GET(a_Dw0)                    (((a_Dw0) >> 20) & 0xf)
 /** Return the engine specific function from the given dword. */
@@ -100,8 +102,23 @@
 
 /** Return the AES encrypt/decrypt flag from the given function. */
 #define CCP_V5_ENGINE_AES_ENCRYPT_GET(a_Func)       (!!(((a_Func) >> 7) & 0x1))
-/** Return the AES size from the given function. */
+/** Return the AES size from the given function (CFB feedback size in bits minus one). */
 #define CCP_V5_ENGINE_AES_SZ_GET(a_Func)            ((a_Func) & 0x7f)
+
+/** AES block size in bytes. */
+#define CCP_V5_ENGINE_AES_BLOCK_SIZE                16
+/** Return the key size in bytes for the given AES type. */
+#define CCP_V5_ENGINE_AES_KEY_SIZE(a_Type)          (16 + (a_Type) * 8)
+/*
+ * The key occupies a single LSB slot and the IV/counter lives in the context slot given by the source memory type
+ * (CCP_V5_MEM_LSB_CTX_ID_GET()). Both are stored little endian in the low bytes of the slot, the remainder is zero.
+ * (The Linux driver places the big endian value right aligned in a 32 byte buffer and copies it with the 256bit
+ * byte swap of the PASSTHRU engine, which reverses the whole slot.)
+ */
+/** Offset of the key in its LSB slot. */
+#define CCP_V5_ENGINE_AES_KEY_SLOT_OFF              0
+/** Offset of the IV/counter in its LSB context slot. */
+#define CCP_V5_ENGINE_AES_IV_SLOT_OFF               0
 /** @} */
 
 /** @name SHA engine specific defines.
@@ -118,6 +135,35 @@
 #define CCP_V5_ENGINE_SHA_TYPE_512                  5
 /** Return the SHA type from the given function. */
 #define CCP_V5_ENGINE_SHA_TYPE_GET(a_Func)          (((a_Func) >> 10) & 0xf)
+/*
+ * A message can be hashed with several descriptors, the first one has the INIT bit set and the last one the EOM bit.
+ * The intermediate state is kept in the LSB context slot(s) given by the source memory type in between, every
+ * descriptor but the last must hash a multiple of the block size. The last one carries the total message length
+ * in bits in Sha.u32ShaBitsLow/High for the padding and leaves the final state in the context.
+ *
+ * The context holds the big endian state H0..Hn (CCP_V5_ENGINE_SHA_CTX_SIZE() bytes) byte reversed, starting
+ * at offset 0 of the first slot, i.e. the state words in reverse order with each word little endian. This is what the
+ * Linux driver produces by placing the state right aligned in 32 byte buffers and copying them with the 256bit byte
+ * swap; for SHA384/512 it puts H4..H7 into the first and H0..H3 into the second buffer, so the 64 byte context
+ * is reversed as a whole as well. The digest is the truncated state, so it is found byte reversed at
+ * CCP_V5_ENGINE_SHA_DIGEST_CTX_OFF() after the last descriptor.
+ */
+/** Return the digest size in bytes for the given SHA type. */
+#define CCP_V5_ENGINE_SHA_DIGEST_SIZE(a_Type)       (  (a_Type) == CCP_V5_ENGINE_SHA_TYPE_1   ? 20 \
+                                                     : (a_Type) == CCP_V5_ENGINE_SHA_TYPE_224 ? 28 \
+                                                     : (a_Type) == CCP_V5_ENGINE_SHA_TYPE_256 ? 32 \
+                                                     : (a_Type) == CCP_V5_ENGINE_SHA_TYPE_384 ? 48 \
+                                                     : 64)
+/** Return the block size in bytes for the given SHA type. */
+#define CCP_V5_ENGINE_SHA_BLOCK_SIZE(a_Type)        ((a_Type) <= CCP_V5_ENGINE_SHA_TYPE_256 ? 64 : 128)
+/** Return the size of the intermediate state in the LSB context in bytes for the given SHA type. */
+#define CCP_V5_ENGINE_SHA_CTX_SIZE(a_Type)          (  (a_Type) == CCP_V5_ENGINE_SHA_TYPE_1 ? 20 \
+                                                     : (a_Type) <= CCP_V5_ENGINE_SHA_TYPE_256 ? 32 \
+                                                     : 64)
+/** Return the number of LSB slots occupied by the intermediate state for the given SHA type. */
+#define CCP_V5_ENGINE_SHA_CTX_SLOTS(a_Type)         ((CCP_V5_ENGINE_SHA_CTX_SIZE(a_Type) + CCP_V5_LSB_SLOT_SIZE - 1) / CCP_V5_LSB_SLOT_SIZE)
+/** Return the offset of the (byte reversed) digest in the LSB context for the given SHA type. */
+#define CCP_V5_ENGINE_SHA_DIGEST_CTX_OFF(a_Type)    (CCP_V5_ENGINE_SHA_CTX_SIZE(a_Type) - CCP_V5_ENGINE_SHA_DIGEST_SIZE(a_Type))
 /** @} */
 
 /** @name PASSTHRU engine specific defines.
@@ -152,8 +198,44 @@
  * @{ */
 /** Returns the RSA mode. */
 #define CCP_V5_ENGINE_RSA_MODE_GET(a_Func)          ((a_Func) & 0x7)
-/** Returns the RSA size. */
+/** Returns the RSA size (modulus size in bytes). */
 #define CCP_V5_ENGINE_RSA_SZ_GET(a_Func)            (((a_Func) >> 3) & 0xfff)
+/*
+ * All operands are little endian (byte reversed) and zero extended to the operand size. The key address and memory
+ * type point to the exponent of the operand size (the Linux driver uses system memory for CCP v5, only earlier
+ * versions copy it into the storage buffer), the source consists of the modulus directly followed by the message
+ * (cbSrc is twice the operand size) and the result of the operand size is written to the destination.
+ */
+/** Returns the operand size in bytes for the given modulus size in bits (multiple of 256 bits). */
+#define CCP_V5_ENGINE_RSA_OPERAND_SIZE(a_cBitsMod)  (CCP_V5_LSB_SLOT_SIZE * (((a_cBitsMod) + 255) / 256))
+/** Maximum modulus size in bits used by the firmware. */
+#define CCP_V5_ENGINE_RSA_MOD_BITS_MAX              4096
+/** @} */
+
+/** @name ZLIB decompression engine specific defines.
+ *
+ * A zlib stream (RFC 1950 header, deflate data and Adler-32 trailer) can be split across several descriptors,
+ * the first one has the INIT bit set and the last one the EOM bit. The status codes map to malformed input like this
+ * (derived from the status names, the hardware behavior is not verified for every case):
+ *     - CCP_V5_STATUS_ZLIB_MISSING_INIT_EOM:     The first descriptor of a stream lacks INIT.
+ *     - CCP_V5_STATUS_ZLIB_UNEXPECTED_EOM:       EOM was reached before the final block and the trailer.
+ *     - CCP_V5_STATUS_ZLIB_EXTRA_DATA:           Input left after the trailer.
+ *     - CCP_V5_STATUS_ZLIB_BTYPE:                Reserved block type 3.
+ *     - CCP_V5_STATUS_ZLIB_UNCOMPRESSED_LEN:     LEN and NLEN of a stored block don't match.
+ *     - CCP_V5_STATUS_ZLIB_CODE_LENGTH_SYMBOL:   Invalid code length code (repeat without a previous length,
+ *                                                 too many lengths or an incomplete/oversubscribed code).
+ *     - CCP_V5_STATUS_ZLIB_UNDEFINED_SYMBOL:     Literal/length symbol 286 or 287.
+ *     - CCP_V5_STATUS_ZLIB_UNDEFINED_DISTANCE_S: Distance symbol 30 or 31 or a distance before the start of the output.
+ *     - CCP_V5_STATUS_ZLIB_LIMIT_REACHED:        The output exceeds the destination buffer.
+ *     - CCP_V5_STATUS_ZLIB_CHECKSUM_MISMATCH:    The Adler-32 trailer doesn't match the output.
+ * @{ */
+/** Return whether the given status code is specific to the ZLIB decompression engine. */
+#define CCP_V5_STATUS_IS_ZLIB(a_Sts)                (   (a_Sts) == CCP_V5_STATUS_ZLIB_MISSING_INIT_EOM \
+                                                     || (a_Sts) == CCP_V5_STATUS_ZLIB_ILLEGAL_MULTI_QUEUE \
+                                                     || (a_Sts) == CCP_V5_STATUS_ZLIB_ILLEGAL_JOBID_CHANGE \
+                                                     || (a_Sts) == CCP_V5_STATUS_ZLIBVHB_AXI_SLVERR \
+                                                     || (a_Sts) == CCP_V5_STATUS_ZLIBVHB_AXI_DECERR \
+                                                     || ((a_Sts) >= CCP_V5_STATUS_ZLIB_UNEXPECTED_EOM && (a_Sts) <= CCP_V5_STATUS_ZLIB_CHECKSUM_MISMATCH))
 /** @} */
 
 /** @name ECC engine specific defines.
@@ -192,6 +274,24 @@
 #define CCP_V5_MEM_LSB_CTX_ID_GET(a_MemType)        (((a_MemType) >> 2) & 0xff)
 /** Retrieve the LSB context ID from the given 16bit word. */
 #define CCP_V5_MEM_LSB_FIXED_GET(a_MemType)         (((a_MemType) >> 16) & 0x1)
+/** Combine the low 32bit and high 16bit parts of a descriptor address into a 64bit address. */
+#define CCP_V5_ADDR_MAKE(a_Low, a_High)             (((uint64_t)((a_High) & 0xffff) << 32) | (uint32_t)(a_Low))
+/** @} */
+
+/** @name Local storage buffer (LSB) layout.
+ * @{ */
+/** Size of a single LSB slot in bytes. */
+#define CCP_V5_LSB_SLOT_SIZE                        32
+/** Number of slots in a single LSB. */
+#define CCP_V5_LSB_SLOTS_PER_LSB                    16
+/** Number of LSBs. */
+#define CCP_V5_LSB_COUNT                            8
+/** Total number of LSB slots. */
+#define CCP_V5_LSB_SLOT_COUNT                       (CCP_V5_LSB_SLOTS_PER_LSB * CCP_V5_LSB_COUNT)
+/** Total size of the storage buffer in bytes (the address space for CCP_V5_MEM_TYPE_SB). */
+#define CCP_V5_LSB_SIZE                             (CCP_V5_LSB_SLOT_COUNT * CCP_V5_LSB_SLOT_SIZE)
+/** Returns the storage buffer address of the given context (slot) ID. */
+#define CCP_V5_LSB_CTX_ADDR(a_idCtx)                ((a_idCtx) * CCP_V5_LSB_SLOT_SIZE)
 /** @} */
 
 /** @name Queue register offsets.
@@ -357,6 +457,10 @@ typedef CCP5REQ *PCCP5REQ;
 /** Pointer to a const request descriptor. */
 typedef const CCP5REQ *PCCCP5REQ;
 
+#ifdef __GNUC__
+_Static_assert(sizeof(CCP5REQ) == 32, "CCP request descriptor has invalid size!");
+#endif
+
 
 /**
  * ECC request number representation.
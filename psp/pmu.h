@@ -0,0 +1,84 @@
+/** @file
+ * PSP hardware - ARM performance monitor (cycle counter) definitions.
+ */
+
+/*
+ * Copyright (C) 2020 Alexander Eichner <alexander.eichner@campus.tu-berlin.de>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef INCLUDED_includes_psp_pmu_h
+#define INCLUDED_includes_psp_pmu_h
+
+/*********************************************************************************************************************************
+*   Header Files                                                                                                                 *
+*********************************************************************************************************************************/
+
+#include <common/cdefs.h>
+
+
+/*********************************************************************************************************************************
+*   Defined Constants And Macros                                                                                                 *
+*********************************************************************************************************************************/
+
+/*
+ * The performance monitor registers live in coprocessor 15 (opc1 0, CRn 9), so they can be accessed
+ * from the external side with PSPSERIALPDURRNID_REQUEST_COPROC_READ/WRITE as well.
+ */
+
+/** The coprocessor the performance monitor registers are accessed through. */
+#define PSP_PMU_COPROC                              15
+/** The CRn value of all performance monitor registers. */
+#define PSP_PMU_CRN                                 9
+/** The opc1 value of all performance monitor registers. */
+#define PSP_PMU_OPC1                                0
+
+/** Performance monitor control register (PMCR), CRm value. */
+#define PSP_PMU_REG_PMCR_CRM                        12
+/** Performance monitor control register (PMCR), opc2 value. */
+#define PSP_PMU_REG_PMCR_OPC2                       0
+/** Enable all counters. */
+# define PSP_PMU_REG_PMCR_E                         BIT(0)
+/** Reset all event counters. */
+# define PSP_PMU_REG_PMCR_P                         BIT(1)
+/** Reset the cycle counter. */
+# define PSP_PMU_REG_PMCR_C                         BIT(2)
+/** The cycle counter increments every 64th cycle. */
+# define PSP_PMU_REG_PMCR_D                         BIT(3)
+
+/** Count enable set register (PMCNTENSET), CRm value. */
+#define PSP_PMU_REG_PMCNTENSET_CRM                  12
+/** Count enable set register (PMCNTENSET), opc2 value. */
+#define PSP_PMU_REG_PMCNTENSET_OPC2                 1
+/** Enable the cycle counter. */
+# define PSP_PMU_REG_PMCNTENSET_C                   ((uint32_t)1 << 31)
+
+/** Cycle count register (PMCCNTR), CRm value. */
+#define PSP_PMU_REG_PMCCNTR_CRM                     13
+/** Cycle count register (PMCCNTR), opc2 value. */
+#define PSP_PMU_REG_PMCCNTR_OPC2                    0
+
+/** User enable register (PMUSERENR), CRm value. */
+#define PSP_PMU_REG_PMUSERENR_CRM                   14
+/** User enable register (PMUSERENR), opc2 value. */
+#define PSP_PMU_REG_PMUSERENR_OPC2                  0
+/** Allow user mode access to the performance monitor registers. */
+# define PSP_PMU_REG_PMUSERENR_EN                   BIT(0)
+
+#endif /* !INCLUDED_includes_psp_pmu_h */
@@ -158,4 +158,23 @@
 /** Divisor latch (MSB). */
 #define X86_UART_REG_DL_MSB_OFF                 1
 
+/** Minimum divisor latch value (0 is invalid). */
+#define X86_UART_DIVISOR_MIN                    1
+/** Maximum divisor latch value (16bit latch). */
+#define X86_UART_DIVISOR_MAX                    0xffff
+
+/** Default UART input clock in Hz. */
+#define X86_UART_CLK_HZ_DEFAULT                 1843200
+/** Returns the divisor latch value for the given input clock and baud rate. */
+#define X86_UART_DIVISOR_FROM_CLK_BAUD(a_uClkHz, a_uBaud) ((a_uClkHz) / (16 * (a_uBaud)))
+/** Returns the baud rate for the given input clock and divisor latch value (the divisor must not be 0). */
+#define X86_UART_BAUD_FROM_CLK_DIVISOR(a_uClkHz, a_uDiv)  ((a_uClkHz) / (16 * (a_uDiv)))
+
+/** Baud rate for a divisor of 1 with the default input clock, the maximum for that clock. */
+#define X86_UART_BAUD_RATE_BASE                 (X86_UART_CLK_HZ_DEFAULT / 16)
+/** Returns the divisor latch value for the given baud rate (at most X86_UART_BAUD_RATE_BASE) with the default clock. */
+#define X86_UART_DIVISOR_FROM_BAUD(a_uBaud)     X86_UART_DIVISOR_FROM_CLK_BAUD(X86_UART_CLK_HZ_DEFAULT, a_uBaud)
+/** Returns the baud rate for the given divisor latch value (must not be 0) with the default clock. */
+#define X86_UART_BAUD_FROM_DIVISOR(a_uDiv)      X86_UART_BAUD_FROM_CLK_DIVISOR(X86_UART_CLK_HZ_DEFAULT, a_uDiv)
+
 #endif /* !__include_x86_uart_h */